@@ -0,0 +1,67 @@
+#!/usr/bin/env bash
+#
+# Builds the Linux GameNetworkingSockets binaries used by gns-jai.
+#
+# Produces, next to this script:
+#   libGameNetworkingSockets.so     shared library, the default in module.jai
+#   libGameNetworkingSockets_s.a    static library, import with #import "gns-jai"(GNS_STATIC_LINK = true) to use it
+#
+# Neither has been tested yet, run examples/benchmarks/smoke.jai after building.
+#
+# Both are built from the same release the bindings were written against, with
+# -O3, link time optimization and STEAMNETWORKINGSOCKETS_ENABLE_MEM_OVERRIDE
+# (needed by NetworkingPoolAllocator).
+#
+# Requirements (Debian/Ubuntu package names):
+#   git cmake ninja-build g++ libssl-dev libprotobuf-dev protobuf-compiler
+#
+# Usage:
+#   linux/build.sh             # Build into linux/_build and copy the results into linux/
+#   BUILD_DIR=/tmp/gns linux/build.sh
+#
+set -euo pipefail
+
+GNS_REPOSITORY=https://github.com/ValveSoftware/GameNetworkingSockets.git
+GNS_TAG=v1.3.0
+GNS_COMMIT=9875f39   # Matches the release listed in README.md
+
+HERE="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+BUILD_DIR="${BUILD_DIR:-$HERE/_build}"
+SOURCE_DIR="$BUILD_DIR/GameNetworkingSockets"
+
+# -ffat-lto-objects keeps regular code next to the LTO bytecode in the static
+# library, so linkers that don't do LTO (like the one Jai invokes) can use it
+FLAGS="-O3 -DNDEBUG -DSTEAMNETWORKINGSOCKETS_ENABLE_MEM_OVERRIDE -fno-plt -ffat-lto-objects"
+
+if [ ! -d "$SOURCE_DIR" ]; then
+    git clone --branch "$GNS_TAG" --depth 1 "$GNS_REPOSITORY" "$SOURCE_DIR"
+fi
+
+commit="$(git -C "$SOURCE_DIR" rev-parse --short=7 HEAD)"
+if [ "$commit" != "$GNS_COMMIT" ]; then
+    echo "Expected GameNetworkingSockets $GNS_TAG at commit $GNS_COMMIT, found $commit" >&2
+    exit 1
+fi
+
+cmake -S "$SOURCE_DIR" -B "$BUILD_DIR/out" -G Ninja \
+    -DCMAKE_BUILD_TYPE=Release \
+    -DCMAKE_C_FLAGS_RELEASE="$FLAGS" \
+    -DCMAKE_CXX_FLAGS_RELEASE="$FLAGS" \
+    -DCMAKE_INTERPROCEDURAL_OPTIMIZATION=ON \
+    -DCMAKE_POSITION_INDEPENDENT_CODE=ON \
+    -DBUILD_SHARED_LIB=ON \
+    -DBUILD_STATIC_LIB=ON \
+    -DBUILD_EXAMPLES=OFF \
+    -DBUILD_TESTS=OFF \
+    -DUSE_CRYPTO=OpenSSL
+
+cmake --build "$BUILD_DIR/out" --target GameNetworkingSockets GameNetworkingSockets_s
+
+shared="$(find "$BUILD_DIR/out" -name 'libGameNetworkingSockets.so' | head -n 1)"
+static="$(find "$BUILD_DIR/out" -name 'libGameNetworkingSockets_s.a' | head -n 1)"
+
+cp "$static" "$HERE/libGameNetworkingSockets_s.a"
+cp "$shared" "$HERE/libGameNetworkingSockets.so"
+strip --strip-unneeded "$HERE/libGameNetworkingSockets.so"
+
+echo "Built $HERE/libGameNetworkingSockets.so and $HERE/libGameNetworkingSockets_s.a ($GNS_TAG, $GNS_COMMIT)"